@@ -21,6 +21,8 @@
 typedef uint64_t entity_id;
 typedef uint64_t archetype_id;
 typedef uint64_t component_id;
+/// Resource handle, index into the instance's resource array
+typedef uint64_t resource_id;
 
 typedef archetype_id* archatype_set; // unordered_set<ArchetypeId>
 
@@ -57,6 +59,10 @@ bool ecs_component_remove(ecs_instance* instance, entity_id entity, component_id
 void ecs_component_set(ecs_instance* instance, entity_id entity, component_id component, size_t size, const void* data);
 void* ecs_component_get(ecs_instance* instance, entity_id entity, component_id component);
 
+resource_id ecs_resource_register(ecs_instance* instance, const char* resource_name, size_t size);
+resource_id ecs_resource_id(ecs_instance* instance, const char* resource_name);
+void* ecs_resource_get(ecs_instance* instance, resource_id resource);
+
 
 
 ///
@@ -66,6 +72,11 @@ void* ecs_component_get(ecs_instance* instance, entity_id entity, component_id c
 /// @brief Register a component to the `ecs_instance`
 /// @param type Component type
 #define COMPONENT_REGISTER(ecs_instance, type) ecs_component_register(ecs_instance, #type, sizeof(type))
+/// @brief Register a resource (singleton) to the `ecs_instance`
+/// @param type Resource type
+/// @note The resource is zeroed and its pointer stays valid until `ecs_destroy`
+/// @note Registering the same name again returns the same handle, or `INVALID_ID` if the size differs
+#define RESOURCE_REGISTER(ecs_instance, type) ecs_resource_register(ecs_instance, #type, sizeof(type))
 /// @brief Get an entity's actual ID (uint32)
 #define ecs_id_uid(id) ((uint32_t) ((id) >> 32))
 /// @brief Get an entity's generation number (uint16)
@@ -107,4 +118,14 @@ void* ecs_component_get(ecs_instance* instance, entity_id entity, component_id c
 /// @brief Get a pointer to an entity's component
 /// @param component Component type
 #define ecs_get(ecs_instance, entity, component) ecs_component_get(ecs_instance, entity, ecs_id_str(ecs_instance, component))
-
+/// @brief Get a resource's handle from its type
+/// @note Hashes the name, so cache the handle instead of calling this every frame
+#define ecs_res_id(ecs_instance, type) ecs_resource_id(ecs_instance, #type)
+/// @brief Get a read-only pointer to a resource
+/// @param resource Handle returned by `RESOURCE_REGISTER` or `ecs_res_id`
+/// @param type Resource type
+#define ecs_res_read(ecs_instance, resource, type) ((const type*) ecs_resource_get(ecs_instance, resource))
+/// @brief Get a writable pointer to a resource
+/// @param resource Handle returned by `RESOURCE_REGISTER` or `ecs_res_id`
+/// @param type Resource type
+#define ecs_res_write(ecs_instance, resource, type) ((type*) ecs_resource_get(ecs_instance, resource))
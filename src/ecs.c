@@ -43,6 +43,11 @@ struct archetype_edge {
 typedef kvec_t(column) vec_column;
 typedef kvec_t(uint64_t) vec_uint64_t;
 typedef vec_uint64_t vec_component_id;
+typedef struct {
+    void* data;  // zeroed buffer with the resource
+    size_t size; // size it was registered with
+} resource_slot;
+typedef kvec_t(resource_slot) vec_resource;
 
 struct archetype_t {
     archetype_id id;       // The hash of `type`
@@ -110,6 +115,12 @@ struct ecs_instance_t {
     // Global component name map, key is component typenames (const char*)
     component_name_map_t* component_names;
 
+    // Global resource storage, index is ResourceId
+    vec_resource resources;
+
+    // Global resource name map, key is resource typenames (const char*)
+    component_name_map_t* resource_names;
+
     vec_uint64_t id_graveyard;
 
     uint32_t next_id;
@@ -213,6 +224,7 @@ int move_entity(ecs_instance* instance, const entity_id entity, archetype* src,
 /// Assumes `type` is sorted
 archetype* archetype_create(ecs_instance* instance, const vec_component_id* type) {
     vec_component_id type_cpy;
+    kv_init(type_cpy);
     kv_copy(component_id, type_cpy, *type);
 
     // Add new archetype to the global archetype index
@@ -269,10 +281,13 @@ ecs_instance* ecs_init() {
     instance->archetype_index = archetype_map_init();
     instance->component_index = component_map_init();
     instance->component_names = component_name_map_init();
+    kv_init(instance->resources);
+    instance->resource_names = component_name_map_init();
     kv_init(instance->id_graveyard);
     instance->next_id = 0;
 
-    if(instance->entity_index && instance->archetype_index && instance->component_index && instance->component_names) {
+    if(instance->entity_index && instance->archetype_index && instance->component_index && instance->component_names &&
+       instance->resource_names) {
         COMPONENT_REGISTER(instance, __intern_comp_size);
 
         return instance;
@@ -287,6 +302,8 @@ ecs_instance* ecs_init() {
         component_map_destroy(instance->component_index);
     if(instance->component_names)
         component_name_map_destroy(instance->component_names);
+    if(instance->resource_names)
+        component_name_map_destroy(instance->resource_names);
     free(instance);
 
     return NULL;
@@ -310,6 +327,11 @@ void ecs_destroy(ecs_instance* instance) {
 
     component_name_map_destroy(instance->component_names);
 
+    for(size_t i = 0; i < kv_size(instance->resources); i++)
+        free(kv_A(instance->resources, i).data);
+    kv_destroy(instance->resources);
+    component_name_map_destroy(instance->resource_names);
+
     kv_destroy(instance->id_graveyard);
 
     free(instance);
@@ -483,3 +505,37 @@ void* ecs_component_get(ecs_instance* instance, const entity_id entity, const co
 
     return comp;
 }
+
+/// Allocates a zeroed resource and returns its handle
+/// Registering an existing name returns the existing handle, or INVALID_ID if `size` differs
+resource_id ecs_resource_register(ecs_instance* instance, const char* resource_name, size_t size) {
+    int absent;
+    khint_t key = component_name_map_put(instance->resource_names, resource_name, &absent);
+    if(absent < 0)
+        return INVALID_ID;
+    if(!absent) {
+        resource_id res_id = kh_val(instance->resource_names, key);
+        return (kv_A(instance->resources, res_id).size == size) ? res_id : INVALID_ID;
+    }
+
+    void* resource = calloc(1, size);
+    if(resource == NULL) {
+        component_name_map_del(instance->resource_names, key);
+        return INVALID_ID;
+    }
+
+    resource_id res_id = kv_size(instance->resources);
+    kv_push(resource_slot, instance->resources, ((resource_slot) { .data = resource, .size = size }));
+    kh_val(instance->resource_names, key) = res_id;
+
+    return res_id;
+}
+resource_id ecs_resource_id(ecs_instance* instance, const char* resource_name) {
+    khint_t key = component_name_map_get(instance->resource_names, resource_name);
+
+    return (key != kh_end(instance->resource_names)) ? kh_val(instance->resource_names, key) : INVALID_ID;
+}
+/// Direct index into the resource array, no hashing
+void* ecs_resource_get(ecs_instance* instance, const resource_id resource) {
+    return (resource < kv_size(instance->resources)) ? kv_A(instance->resources, resource).data : NULL;
+}
@@ -13,6 +13,9 @@ typedef struct {
 typedef struct {
     const char* name;
 } name_comp;
+typedef struct {
+    float delta;
+} time_res;
 
 int main(int argc, char** argv) {
     ecs_instance* world = ecs_init();
@@ -53,6 +56,17 @@ int main(int argc, char** argv) {
     name = (name_comp*) ecs_get(world, e2, name_comp);
     printf("e2 is: %s\n", name->name);
 
+    resource_id time = RESOURCE_REGISTER(world, time_res);
+    printf("time id: %016lx\n", time);
+    printf("re-register same handle: %s\n", (RESOURCE_REGISTER(world, time_res) == time) ? "yes" : "no");
+    printf("size mismatch rejected:  %s\n", (ecs_resource_register(world, "time_res", 1) == INVALID_ID) ? "yes" : "no");
+    printf("lookup same handle:      %s\n", (ecs_res_id(world, time_res) == time) ? "yes" : "no");
+    printf("invalid handle is NULL:  %s\n", (ecs_resource_get(world, INVALID_ID) == NULL) ? "yes" : "no");
+    printf("fresh delta: %f\n", ecs_res_read(world, time, time_res)->delta);
+
+    ecs_res_write(world, time, time_res)->delta = 1.f / 60.f;
+    printf("delta: %f\n", ecs_res_read(world, time, time_res)->delta);
+
     ecs_destroy(world);
     return 0;
 }